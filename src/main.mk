@@ -26,6 +26,7 @@ TARGET       := libcanu.a
 
 SOURCES      := AS_global.C \
                 \
+                AS_UTL/AS_UTL_decompress.C \
                 AS_UTL/AS_UTL_fasta.C \
                 AS_UTL/AS_UTL_fileIO.C \
                 AS_UTL/AS_UTL_reverseComplement.C \
@@ -56,6 +57,7 @@ SOURCES      := AS_global.C \
                 stores/sqStore.C \
                 stores/sqStoreConstructor.C \
                 stores/sqStoreInfo.C \
+                stores/sqStoreBlobReader.C \
                 stores/sqStoreEncode.C \
                 stores/sqStorePartition.C \
                 \
@@ -157,7 +159,6 @@ SRC_INCDIRS  := . \
                 utgcns/libcns \
                 utgcns/libpbutgcns \
                 utgcns/libNDFalcon \
-                utgcns/libboost \
                 meryl/libleaff \
                 overlapInCore \
                 overlapInCore/libedlib \
@@ -171,6 +172,7 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 stores/ovStoreIndexer.mk \
                 stores/ovStoreDump.mk \
                 stores/ovStoreStats.mk \
+                stores/ovStoreBenchmark.mk \
                 stores/sqStoreCreate.mk \
                 stores/sqStoreCreatePartition.mk \
                 stores/sqStoreDumpFASTQ.mk \
@@ -203,6 +205,7 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 overlapInCore/overlapImport.mk \
                 overlapInCore/overlapPair.mk \
                 overlapInCore/edalign.mk \
+                overlapInCore/edlibBenchmark.mk \
                 \
                 overlapInCore/liboverlap/prefixEditDistance-matchLimitGenerate.mk \
                 \
@@ -13,7 +13,8 @@ SOURCES  := overlapInCore.C \
             overlapInCore-Find_Overlaps.C \
             overlapInCore-Output.C \
             overlapInCore-Process_Overlaps.C \
-            overlapInCore-Process_String_Overlaps.C
+            overlapInCore-Process_String_Overlaps.C \
+            overlapInCore-Work_Queue.C
 
 SRC_INCDIRS  := .. ../AS_UTL ../stores liboverlap
 
@@ -116,6 +116,7 @@ sub utgcns ($$$) {
     print F "  -edlib    \\\n"   if (getGlobal("canuIteration") >= 0);
     print F "  -utgcns \\\n"     if (getGlobal("cnsConsensus") eq "utgcns");
     print F "  -threads " . getGlobal("cnsThreads") . " \\\n";
+    print F "  -M " . getGlobal("cnsMemory") . " \\\n";
     print F "&& \\\n";
     print F "mv ./\${tag}cns/\$jobid.cns.WORKING ./\${tag}cns/\$jobid.cns \\\n";
     print F "\n";
@@ -235,6 +236,10 @@ sub consensusConfigure ($) {
     my $ctgjobs = computeNumberOfConsensusJobs($asm, "ctg");
     my $utgjobs = computeNumberOfConsensusJobs($asm, "utg");
 
+    #  Decide on memory and threads now; both are written into the script.
+
+    estimateMemoryNeededForConsensusJobs($asm);
+
     #  This configure is an odd-ball.  Unlike all the other places that write scripts,
     #  we'll rewrite this one every time, so that we can change the alignment algorithm
     #  on the second attempt.
@@ -288,7 +293,10 @@ sub estimateMemoryNeededForConsensusJobs ($) {
 
     my $maxLen = ($ctgLen < $utgLen) ? $utgLen : $ctgLen;
 
-    #  Expect to use 1GB memory for every 1Mbp of sequence.
+    #  Expect to use 1GB memory for every 1Mbp of sequence.  This is enough to
+    #  compute the largest tig.  utgcns computes several tigs at once only if
+    #  they fit in cnsMemory (its -M option) and computes the rest one at a
+    #  time, so more memory only allows more tigs to be computed in parallel.
 
     my $minMem = int($maxLen / 1000000 + 0.5) + 1;
     my $curMem = getGlobal("cnsMemory");
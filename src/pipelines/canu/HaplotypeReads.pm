@@ -122,23 +122,37 @@ sub estimateMemoryNeededForHaplotypeJobs ($) {
     my $path    = "haplotype/2-correction";
 
     my $memEst   = 0;
+    my $merBytes = 0;
 
     return   if (defined(getGlobal("corMemory")));
 
     my @haplotypes = getHaplotypes("haplotype");
     my $merSize    = getGlobal("${tag}OvlMerSize");
 
+    #  Every haplotype is loaded into an existDB at the same time, at about
+    #  twice the size of its mer file.
+
     foreach my $haplotype (@haplotypes) {
-       fetchFile("haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat");
+        fetchFile("haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat");
 
-       if (-e "haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat") {
-          my $size = -s "haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat";
-          $memEst = int($size / 1073741824.0 + 0.5) * 2;
+        if (-e "haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat") {
+            $merBytes += -s "haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.only.mcdat";
         }
-        close(F);
     }
 
-    if ($memEst == 0) {
+    #  Reads are classified in batches of 10000 (batchSize in splitHaplotype),
+    #  the whole batch loaded at once for all threads to share.  Allow two
+    #  bytes per base of an average read.  The state each thread keeps while
+    #  classifying one read is a few kilobytes and is ignored.  The extra GB
+    #  covers the process itself.
+
+    my $nReads     = getNumberOfReadsInStore($asm, "hap");
+    my $nBases     = getNumberOfBasesInStore($asm, "hap");
+    my $batchBytes = ($nReads > 0) ? 10000 * 2 * $nBases / $nReads : 0;
+
+    if ($merBytes > 0) {
+        $memEst = int((2 * $merBytes + $batchBytes) / 1073741824.0 + 0.5) + 1;
+    } else {
         $memEst = 12;
     }
 
@@ -248,49 +262,34 @@ sub haplotypeConfigure ($) {
         print F "\n";
     }
 
-    print F "\n";
-    print F "\$bin/sqStoreDumpFASTQ \\\n";
-    print F "  -S \$seqStore \\\n";
-    print F "  -o ./results/\$jobid.fasta.WORKING \\\n";
-    print F "  -r \$bgn-\$end \\\n";
-    print F "  -fasta -nolibname -noreadname \\\n";
-    print F "  > ./results/\$jobid.err 2>&1 \\\n";
-    print F "&& \\\n";
-    print F "mv ./results/\$jobid.fasta.WORKING.fasta ./results/\$jobid.fasta \\\n";
-    print F "\n";
-
     my @haplotypes = getHaplotypes($base);
     my $merSize    = getGlobal("${tag}OvlMerSize");
-    my $lo         = 0;
-    my $hi         = 1000;
+
+    #  Classify reads directly from the store, against the kmers found only
+    #  in each haplotype.
+
+    print F "\n";
+    print F "\$bin/splitHaplotype \\\n";
+    print F "  -S \$seqStore \\\n";
+    print F "  -p ./results/\$jobid \\\n";
+    print F "  -m $merSize \\\n";
 
     foreach my $haplotype (@haplotypes) {
        fetchFile("$base/0-mercounts-$haplotype/$haplotype.ms$merSize.threshold");
        open(T, "< haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.threshold") or caExit("can't open haplotype/0-mercounts-$haplotype/$haplotype.ms$merSize.threshold", undef);
        my $rn = <T>;
        ($rn =~ m/^(\d+)\s+(\d+)$/);
-       $lo = $1;
-       $hi = $2;
+       my $lo = $1;
+       my $hi = $2;
        close(T);
 
-       print F "\$bin/simple-dump \\\n";
-       print F "  -m $merSize \\\n";
-       print F "  -s ../0-mercounts-$haplotype/$haplotype.ms$merSize.only \\\n";
-       print F "  -l $lo -h $hi -f ./results/\$jobid.fasta \\\n";
-       print F "  > ./results/\$jobid.$haplotype.WORKING \\\n";
-       print F "&& \\\n";
-       print F "mv ./results/\$jobid.$haplotype.WORKING ./results/\$jobid.$haplotype \\\n";
-       print F "\n";
+       print F "  -H $haplotype ../0-mercounts-$haplotype/$haplotype.ms$merSize.only $lo $hi \\\n";
     }
-    print F "join results/\$jobid.haplotype* |awk '{print \$1\" \"\$4\" \"\$5\" \"\$8\" \"\$NF}'|awk '{print \$1\" \"\$3/\$2\" \"\$NF/\$(NF-1)}'|awk '{if (\$2 == 0 && \$3 == 0) print \$1\" ambiguous\"; else if (\$2 < \$3) { print \$1\" haplotype2\"; } else if (\$2 > \$3) { print \$1\" haplotype1\"; } else print \$1\" ambiguous\"}'|awk '{print \$NF}'|sort |uniq -c\n";
 
-    # now classify and dump the fasta
-    print F "\$bin/splitHaplotype \\\n";
-    print F "  -S \$seqStore \\\n";
-    print F "  -p results/\$jobid \\\n";
-    print F "  -h " . join(" ", @haplotypes) . "\\\n";
     print F "  -cr 1 -cl " . getGlobal("minReadLength") . " \\\n";
     print F "  -b \$bgn -e \$end \\\n";
+    print F "  -threads " . getGlobal("corThreads") . " \\\n";
+    print F "  > ./results/\$jobid.err 2>&1 \\\n";
     print F "&& \\\n";
     print F "touch ./results/\$jobid.success \\\n";
     print F "\n";
@@ -587,6 +587,7 @@ sub overlapErrorAdjustmentConfigure ($) {
     print F "  -R \$minid \$maxid \\\n";
     print F "  -e " . getGlobal("utgOvlErrorRate") . " -l " . getGlobal("minOverlapLength") . " \\\n";
     print F "  -c ./red.red \\\n";
+    print F "  -t " . getGlobal("oeaThreads") . " \\\n";
     print F "  -o ./\$jobid.oea.WORKING \\\n";
     print F "&& \\\n";
     print F "mv ./\$jobid.oea.WORKING ./\$jobid.oea\n";